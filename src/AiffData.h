@@ -264,6 +264,17 @@ readMarkerData( std::istream & s, MarkerCk & ck, unsigned long chunkSize );
 std::istream & 
 readSampleData( std::istream & s, SoundDataCk & ck, unsigned long chunkSize );
 
+// ---------------------------------------------------------------------------
+//	readSampleDataHeader
+// ---------------------------------------------------------------------------
+//	Read the offset and block size in the Sound Data chunk, assume the 
+//	stream is correctly positioned, and that the chunk header has already 
+//	been read. Skip ahead to the samples, and return the number of bytes 
+//	of sample data in the chunk. The samples are not read.
+//
+unsigned long
+readSampleDataHeader( std::istream & s, SoundDataCk & ck, unsigned long chunkSize );
+
 // ---------------------------------------------------------------------------
 //	configureCommonCk
 // ---------------------------------------------------------------------------
@@ -346,6 +357,30 @@ void
 convertBytesToSamples( const std::vector< Byte > & bytes, 
 					   std::vector< double > & samples, unsigned int bps );
 
+// ---------------------------------------------------------------------------
+//	convertBytesToSamples
+// ---------------------------------------------------------------------------
+//	Convert numSamples samples, starting at bytes and separated by stride
+//	bytes, to double precision floating point samples (-1.0, 1.0) stored
+//	in consecutive positions starting at samples. Use a stride equal to
+//	the size of a sample frame to convert one channel of interleaved
+//	sample frames.
+//
+void
+convertBytesToSamples( const Byte * bytes, unsigned long numSamples, 
+					   unsigned int bps, unsigned int stride, double * samples );
+
+// ---------------------------------------------------------------------------
+//	convertBytesToSamples
+// ---------------------------------------------------------------------------
+//	Convert numSamples samples, starting at bytes and separated by stride
+//	bytes, to single precision floating point samples (-1.0, 1.0), as 
+//	above.
+//
+void
+convertBytesToSamples( const Byte * bytes, unsigned long numSamples, 
+					   unsigned int bps, unsigned int stride, float * samples );
+
 // ---------------------------------------------------------------------------
 //	convertSamplesToBytes
 // ---------------------------------------------------------------------------
@@ -73,6 +73,100 @@ public:
     //! The type of AIFF marker storage in an AiffFile.
     typedef std::vector< Marker > markers_type;
 
+// ---------------------------------------------------------------------------
+//  class AiffFile::Reader
+//
+//! Class Reader provides access to the sample data in an AIFF-format
+//! samples file, without storing all the samples. Any range of sample
+//! frames can be read and converted into a buffer provided by the 
+//! caller, and a single channel can be read from a multi-channel file, 
+//! without converting (or storing) the other channels. Only the header 
+//! information and a small, fixed-size block of sample bytes are stored, 
+//! so files that are too large to import can be processed piece by 
+//! piece.
+//
+    class Reader
+    {
+    public:
+    
+        //! Open the AIFF samples file having the specified filename or 
+        //! path, and read the header information (everything but the 
+        //! samples).
+        //!
+        //! \param filename is the name or path of an AIFF samples file
+        //! \throw FileIOException if the file cannot be opened or is not
+        //!        a valid AIFF file.
+        explicit Reader( const std::string & filename );
+        
+        //! Destroy this Reader, closing the file.
+        ~Reader( void );
+        
+        //! Return the Markers (see Marker.h) in the file.
+        const markers_type & markers( void ) const;
+        
+        //! Return the fractional MIDI note number assigned to the file,
+        //! 60.0 if none is specified.
+        double midiNoteNumber( void ) const;
+        
+        //! Return the number of channels of audio samples in the file.
+        unsigned int numChannels( void ) const;
+        
+        //! Return the number of sample frames in the file.
+        size_type numFrames( void ) const;
+        
+        //! Return the sampling freqency in Hz of the samples in the file.
+        double sampleRate( void ) const;
+        
+        //! Read and convert to floating point (-1.0, 1.0) the samples in
+        //! howMany sample frames starting at the specified frame, or 
+        //! as many as there are before the end of the file, storing 
+        //! them in the buffer. For multi-channel files, the samples are
+        //! interleaved (one sample per channel in every frame). Return 
+        //! the number of sample frames read.
+        //!
+        //! \param firstFrame is the index of the first frame to read.
+        //! \param howMany is the number of frames to read.
+        //! \param buffer is a pointer to a buffer having space for 
+        //!        howMany * numChannels() samples.
+        //! \throw FileIOException if the samples cannot be read.
+        size_type read( size_type firstFrame, size_type howMany, double * buffer );
+        
+        //! Read and convert to floating point (-1.0, 1.0) the samples 
+        //! in one channel of the file, in howMany sample frames starting 
+        //! at the specified frame, or as many as there are before the 
+        //! end of the file, storing them in the buffer. Return the number 
+        //! of samples read.
+        //!
+        //! \param channel is the channel to read, 0 for the first (left).
+        //! \param firstFrame is the index of the first frame to read.
+        //! \param howMany is the number of samples to read.
+        //! \param buffer is a pointer to a buffer having space for 
+        //!        howMany samples.
+        //! \throw InvalidArgument if there is no such channel.
+        //! \throw FileIOException if the samples cannot be read.
+        size_type readChannel( unsigned int channel, size_type firstFrame, 
+                               size_type howMany, double * buffer );
+        
+        //! Read and convert to single precision floating point (-1.0, 1.0)
+        //! the samples in howMany sample frames starting at the specified 
+        //! frame, as above. Single precision samples need only half the 
+        //! storage.
+        size_type read( size_type firstFrame, size_type howMany, float * buffer );
+        
+        //! Read and convert to single precision floating point (-1.0, 1.0)
+        //! the samples in one channel of the file, as above.
+        size_type readChannel( unsigned int channel, size_type firstFrame, 
+                               size_type howMany, float * buffer );
+        
+    private:
+        struct Impl;
+        Impl * impl_;   //  insulating implementation (defined in AiffFile.C)
+        
+        //  not implemented
+        Reader( const Reader & );
+        Reader & operator=( const Reader & );
+    };
+
 //  -- construction --
 
     //! Initialize an instance of AiffFile by importing sample data from
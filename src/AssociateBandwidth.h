@@ -67,6 +67,11 @@ class AssociateBandwidth
 	
 	double _regionRate;				//	inverse of region center spacing
 	
+	std::vector< int > _retainedBelow;		//	region below each retained 
+											//	peak (reused for every frame)
+	std::vector< double > _retainedAlpha;	//	contribution of each retained 
+											//	peak to the region above it
+	
 //	-- public interface --
 public:
 	//	construction:
@@ -85,18 +90,10 @@ public:
 		
 //	-- private helpers --	
 private:	
-	double computeNoiseEnergy( double freq, double amp );
-	
-	//	These four formerly comprised the public interface
-	//	to this policy, now they are all hidden behind a 
-	//	single call to associateBandwidth.
+	double computeNoiseEnergy( int posBelow, double alpha, double amp ) const;
 	
 	//	energy accumulation:
 	void accumulateNoise( double freq, double amp );	
-	void accumulateSinusoid( double freq, double amp  );	
-	
-	//	bandwidth assocation:
-	void associate( SpectralPeak & pk );
 	
 	//	call this to wipe out the accumulated energy to 
 	//	prepare for the next frame (yuk):
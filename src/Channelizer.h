@@ -36,6 +36,7 @@
 #include "PartialList.h"
 
 #include <memory>
+#include <vector>
 
 //  begin namespace
 namespace Loris {
@@ -249,6 +250,26 @@ public:
     //! \return the fractional channel number corresponding to the specified
     //!         frequency and time
     double computeFractionalChannelNumber( double time, double frequency ) const;
+
+    //! Compute the (fractional) channel number estimates for a sequence
+    //! of Partial frequencies at a sequence of times, the same as calling
+    //! computeFractionalChannelNumber for each (time, frequency) pair. 
+    //! The reference envelope is evaluated for all times at once (see 
+    //! Envelope::valuesAt), which is much faster when the times are in 
+    //! increasing order, as they are for the Breakpoints in a Partial.
+    //!
+    //! \param  times is an array of n times (in seconds) at which to 
+    //!         evaluate the reference envelope
+    //! \param  freqs is an array of n frequencies (in Hz) for which the 
+    //!         channel numbers are to be determined
+    //! \param  chans is an array of n fractional channel numbers, one
+    //!         for each (time, frequency) pair, it must not overlap
+    //!         either of the other arrays
+    //! \param  n is the number of channel numbers to compute
+    void computeFractionalChannelNumbers( const double * times, 
+                                          const double * freqs,
+                                          double * chans, 
+                                          unsigned long n ) const;
     
     
     //! Compute the reference frequency at the specified time. For non-stretched 
@@ -446,6 +467,19 @@ public:
     //!             floating point number, or 0 for pefectly tuned harmonics
     //!             (that is, for harmonic frequencies fn = n*f1).
     static double computeStretchFactor( double f1, double fn, double n );
+
+private:
+
+//  -- helpers --
+
+    //! Label a Partial with the number of the frequency channel corresponding
+    //! to the average frequency over all the Partial's Breakpoints, using the
+    //! specified buffers to store the Breakpoint times and frequencies
+    //! and the fractional channel numbers, so that the buffers can be
+    //! reused when channelizing many Partials.
+    void channelize( Partial & partial, std::vector< double > & times, 
+                     std::vector< double > & freqs, 
+                     std::vector< double > & chans ) const;
     
 };  //  end of class Channelizer
 
@@ -471,9 +505,11 @@ inline
 void Channelizer::channelize( PartialList::iterator begin, PartialList::iterator end ) const
 #endif
 {
+    //  reuse the same buffers for all the Partials:
+    std::vector< double > times, freqs, chans;
     while ( begin != end )
     {
-        channelize( *begin++ );
+        channelize( *begin++, times, freqs, chans );
     }
 }
 
@@ -515,10 +551,7 @@ void Channelizer::channelize( PartialList::iterator begin, PartialList::iterator
 #endif   
 {
    Channelizer instance( refChanFreq, refChanLabel );
-    while ( begin != end )
-    {
-        instance.channelize( *begin++ );
-    }
+   instance.channelize( begin, end );
 }
 
 }   //  end of namespace Loris
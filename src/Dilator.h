@@ -37,6 +37,7 @@
 #include "PartialList.h"
 #endif
 
+#include <algorithm>
 #include <vector>
 
 //	begin namespace
@@ -242,6 +243,16 @@ public:
 				 const double * tbegin  );
 #endif
 
+private:
+
+//	-- helpers --
+
+	//!	Return the dilated time value corresponding to the specified 
+	//!	initial time, given the index of the first initial time point
+	//!	not earlier than that time.
+	double warpTime( double currentTime, 
+					 std::vector< double >::size_type idx ) const;
+
 };	//	end of class Dilator
 
 
@@ -274,8 +285,13 @@ Dilator::Dilator( const double * ibegin, const double * iend, const double * tbe
 {
 	while ( ibegin != iend )
 	{
-		insert( *ibegin++, *tbegin++ );
+		_initial.push_back( *ibegin++ );
+		_target.push_back( *tbegin++ );
 	}
+
+	//	sort the time points before dilating:
+	std::sort( _initial.begin(), _initial.end() );
+	std::sort( _target.begin(), _target.end() );
 }
 
 // ---------------------------------------------------------------------------
@@ -73,6 +73,21 @@ public:
 
 	//!	Return the value of this Envelope at the specified time. 	 
 	virtual double valueAt( double x ) const = 0;	
+
+	//!	Evaluate this Envelope at each of a sequence of times, 
+	//!	storing the values in the specified array. The default
+	//!	implementation calls valueAt for each time, derived classes
+	//!	may override to evaluate the Envelope more efficiently when
+	//!	the times are in increasing order, as they are when 
+	//!	evaluating at the times of the Breakpoints in a Partial.
+	//!
+	//!	\param	times is an array of n times at which to evaluate
+	//!			this Envelope
+	//!	\param	values is an array of n values in which to store
+	//!			the values of this Envelope at those times
+	//!	\param	n is the number of times at which to evaluate
+	virtual void valuesAt( const double * times, double * values, 
+						   unsigned long n ) const;
 	
 };	//	end of abstract class Envelope
 
@@ -133,6 +148,18 @@ public:
 	{
 		return m_offset + ( m_scale * m_env->valueAt( x ) );
 	}
+
+	//!	Evaluate this Envelope at each of a sequence of times,
+	//!	delegating to the scaled and offset Envelope.
+	virtual void valuesAt( const double * times, double * values, 
+						   unsigned long n ) const
+	{
+		m_env->valuesAt( times, values, n );
+		for ( unsigned long k = 0; k < n; ++k )
+		{
+			values[k] = m_offset + ( m_scale * values[k] );
+		}
+	}
 	
 //  -- private member variables --
 
@@ -104,6 +104,28 @@ public:
                 double fmin, double fmax,
                 double resolution );
                 
+    //! Storage for the intermediate results of the estimation
+    //! algorithm. A Workspace can be reused for many estimates, 
+    //! so that no memory needs to be allocated once its buffers 
+    //! have grown to accommodate the largest estimate.
+    
+    struct Workspace
+    {
+        std::vector< double > powers;       //!  squared peak amplitudes
+        std::vector< double > candidates;   //!  candidate F0 frequencies
+        std::vector< double > likelihood;   //!  likelihood of each candidate
+    };
+                
+    //! Construct from parameters of the iterative F0 estimation 
+    //! algorithm, as above, using the specified Workspace for
+    //! storage of intermediate results. 
+
+    F0Estimate( const std::vector<double> & amps, 
+                const std::vector<double> & freqs, 
+                double fmin, double fmax,
+                double resolution,
+                Workspace & workspace );
+                
     //  default copy/assign/destroy are OK
 
 
@@ -125,6 +147,19 @@ public:
         
     double confidence( void ) const { return m_confidence; }
     
+private:
+
+    //  --- implementation ---
+    
+    //! Compute the estimate, storing intermediate results
+    //! in the specified Workspace.
+    
+    void estimate( const std::vector<double> & amps, 
+                   const std::vector<double> & freqs, 
+                   double fmin, double fmax,
+                   double resolution,
+                   Workspace & workspace );
+    
 
                     
 };  //  end of class F0Estimate
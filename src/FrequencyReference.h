@@ -125,6 +125,11 @@ public:
 	//!	specified time.
 	virtual double valueAt( double x ) const;	
 
+	//!	Evaluate this FrequencyReference at each of a sequence of 
+	//!	times, storing the frequencies (in Hz) in the specified array.
+	virtual void valuesAt( const double * times, double * values, 
+						   unsigned long n ) const;
+
 };	// end of class FrequencyReference
 
 }	//	end of namespace Loris
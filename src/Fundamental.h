@@ -47,6 +47,8 @@
 namespace Loris {
 
 class ReassignedSpectrum;
+class SpectralPeak;
+class SpectralPeakSelector;
 
 // ---------------------------------------------------------------------------
 //  class FundamentalEstimator
@@ -233,6 +235,16 @@ public:
     //! Destructor    
     ~FundamentalFromSamples( void );
 
+    //! Construct a copy of an estimator. The copy has the same 
+    //! parameters, but its own spectrum analyzer, so an estimator 
+    //! and its copy can be used to build envelopes for different 
+    //! spans of time (or different sounds) independently.
+    FundamentalFromSamples( const FundamentalFromSamples & );
+
+    //! Make this estimator a copy of another, having the same
+    //! parameters, but keeping its own spectrum analyzer.
+    FundamentalFromSamples & operator= ( const FundamentalFromSamples & );
+
 //  -- fundamental frequency estimation --
 
     //  buildEnvelope
@@ -252,7 +264,7 @@ public:
     //!         fundamental frequency envelope (in seconds)
     //! \param  lowerFreqBound is the lower bound on the fundamental
     //!         frequency estimate (in Hz)
-    //! \param  upperFreqBound is the lower bound on the fundamental
+    //! \param  upperFreqBound is the upper bound on the fundamental
     //!         frequency estimate (in Hz)
     //! \param  confidenceThreshold is the minimum confidence level
     //!         resuired for a fundamental frequency estimate to be
@@ -290,7 +302,7 @@ public:
     //!         fundamental frequency envelope (in seconds)
     //! \param  lowerFreqBound is the lower bound on the fundamental
     //!         frequency estimate (in Hz)
-    //! \param  upperFreqBound is the lower bound on the fundamental
+    //! \param  upperFreqBound is the upper bound on the fundamental
     //!         frequency estimate (in Hz)
     //! \param  confidenceThreshold is the minimum confidence level
     //!         resuired for a fundamental frequency estimate to be
@@ -334,7 +346,7 @@ public:
     //!         fundamental frequency envelope (in seconds)
     //! \param  lowerFreqBound is the lower bound on the fundamental
     //!         frequency estimate (in Hz)
-    //! \param  upperFreqBound is the lower bound on the fundamental
+    //! \param  upperFreqBound is the upper bound on the fundamental
     //!         frequency estimate (in Hz)
     //! \param  confidenceThreshold is the minimum confidence level
     //!         resuired for a fundamental frequency estimate to be
@@ -360,6 +372,76 @@ public:
                               confidenceThreshold );
     }
 
+
+    //  buildEnvelope
+    //
+    //! Construct a linear envelope from fundamental frequency 
+    //! estimates taken at a sub-range of the time steps of a span,
+    //! the time steps numbered firstStep up to (but not including)
+    //! endStep, step k being at time tbeg + k * interval (seconds).
+    //! Estimates for all the time steps of the span tbeg to tend
+    //! are made by building envelopes for the steps 0 to 
+    //! numEstimates( tbeg, tend, interval ) in any number of 
+    //! sub-ranges, each using its own copy of this estimator if
+    //! necessary, and merging them using mergeEnvelopes. The
+    //! result is identical to the envelope built for the whole span.
+    //! 
+    //! \param  sampsBeg is the beginning of a sequence of samples
+    //! \param  sampsEnd is the end of the sequence of samples
+    //! \param  sampleRate is the sampling rate (in Hz) associated
+    //!         with the sequence of samples (used to compute frequencies
+    //!         in Hz, and to convert the time from seconds to samples)
+    //! \param  tbeg is the beginning of the time interval (in seconds),
+    //!         the time of step 0
+    //! \param  interval is the time between breakpoints in the
+    //!         fundamental frequency envelope (in seconds)
+    //! \param  firstStep is the number of the first time step 
+    //!         at which to estimate the fundamental
+    //! \param  endStep is the number of the time step after the 
+    //!         last one at which to estimate the fundamental
+    //! \param  lowerFreqBound is the lower bound on the fundamental
+    //!         frequency estimate (in Hz)
+    //! \param  upperFreqBound is the upper bound on the fundamental
+    //!         frequency estimate (in Hz)
+    //! \param  confidenceThreshold is the minimum confidence level
+    //!         required for a fundamental frequency estimate to be
+    //!         added to the envelope
+    //! \return a LinearEnvelope composed of breakpoints corresponding to
+    //!         the fundamental frequency estimates at the specified time
+    //!         steps having confidence level exceeding the specified 
+    //!         confidence threshold
+    LinearEnvelope buildEnvelope( const double * sampsBeg, 
+                                  const double * sampsEnd, 
+                                  double sampleRate, 
+                                  double tbeg, double interval,
+                                  unsigned long firstStep, 
+                                  unsigned long endStep,
+                                  double lowerFreqBound, double upperFreqBound, 
+                                  double confidenceThreshold );
+
+    //  numEstimates
+    //
+    //! Return the number of time steps, at the specified interval, 
+    //! in the span tbeg to tend (not including tend), that is, the
+    //! number of fundamental frequency estimates that buildEnvelope
+    //! attempts to make in that span.
+    //!
+    //! \param  tbeg is the beginning of the time interval (in seconds)
+    //! \param  tend is the end of the time interval (in seconds)
+    //! \param  interval is the time between estimates (in seconds)
+    static unsigned long numEstimates( double tbeg, double tend, double interval );
+
+    //  mergeEnvelopes
+    //
+    //! Return a LinearEnvelope having all the breakpoints of two
+    //! envelopes, such as the envelopes built for two sub-ranges
+    //! of the time steps of a span. If both envelopes have a 
+    //! breakpoint at the same time, the one from the second is used.
+    //!
+    //! \param  first is one of the envelopes to merge
+    //! \param  second is the other envelope to merge
+    static LinearEnvelope mergeEnvelopes( const LinearEnvelope & first, 
+                                          const LinearEnvelope & second );
                                  
     //  estimateAt
     //
@@ -378,7 +460,7 @@ public:
     //!         the fundamental frequency
     //! \param  lowerFreqBound is the lower bound on the fundamental
     //!         frequency estimate (in Hz)
-    //! \param  upperFreqBound is the lower bound on the fundamental
+    //! \param  upperFreqBound is the upper bound on the fundamental
     //!         frequency estimate (in Hz)
     //! \return the estimate of fundamental frequency in Hz and the 
     //!         confidence associated with that estimate (see 
@@ -407,7 +489,7 @@ public:
     //!         the fundamental frequency
     //! \param  lowerFreqBound is the lower bound on the fundamental
     //!         frequency estimate (in Hz)
-    //! \param  upperFreqBound is the lower bound on the fundamental
+    //! \param  upperFreqBound is the upper bound on the fundamental
     //!         frequency estimate (in Hz)
     //! \return the estimate of fundamental frequency in Hz and the 
     //!         confidence associated with that estimate (see 
@@ -439,7 +521,7 @@ public:
     //!         the fundamental frequency
     //! \param  lowerFreqBound is the lower bound on the fundamental
     //!         frequency estimate (in Hz)
-    //! \param  upperFreqBound is the lower bound on the fundamental
+    //! \param  upperFreqBound is the upper bound on the fundamental
     //!         frequency estimate (in Hz)
     //! \return the estimate of fundamental frequency in Hz and the 
     //!         confidence associated with that estimate (see 
@@ -527,11 +609,6 @@ private:
     double m_windowWidth;       //! the width of the main lobe of the window to 
                                 //! be used in spectral analysis, in Hz
     
-//  disallow these until they are implemented
-
-    FundamentalFromSamples( const FundamentalFromSamples & );
-    FundamentalFromSamples & operator= ( const FundamentalFromSamples & );
-
 };   //  end of class FundamentalFromSamples
 
 
@@ -589,7 +666,7 @@ public:
     //!         fundamental frequency envelope (in seconds)
     //! \param  lowerFreqBound is the lower bound on the fundamental
     //!         frequency estimate (in Hz)
-    //! \param  upperFreqBound is the lower bound on the fundamental
+    //! \param  upperFreqBound is the upper bound on the fundamental
     //!         frequency estimate (in Hz)
     //! \param  confidenceThreshold is the minimum confidence level
     //!         resuired for a fundamental frequency estimate to be
@@ -622,7 +699,7 @@ public:
     //!         fundamental frequency envelope (in seconds)
     //! \param  lowerFreqBound is the lower bound on the fundamental
     //!         frequency estimate (in Hz)
-    //! \param  upperFreqBound is the lower bound on the fundamental
+    //! \param  upperFreqBound is the upper bound on the fundamental
     //!         frequency estimate (in Hz)
     //! \param  confidenceThreshold is the minimum confidence level
     //!         resuired for a fundamental frequency estimate to be
@@ -662,7 +739,7 @@ public:
     //!         the fundamental frequency
     //! \param  lowerFreqBound is the lower bound on the fundamental
     //!         frequency estimate (in Hz)
-    //! \param  upperFreqBound is the lower bound on the fundamental
+    //! \param  upperFreqBound is the upper bound on the fundamental
     //!         frequency estimate (in Hz)
     //! \return the estimate of fundamental frequency in Hz and the 
     //!         confidence associated with that estimate (see 
@@ -685,7 +762,7 @@ public:
     //!         the fundamental frequency
     //! \param  lowerFreqBound is the lower bound on the fundamental
     //!         frequency estimate (in Hz)
-    //! \param  upperFreqBound is the lower bound on the fundamental
+    //! \param  upperFreqBound is the upper bound on the fundamental
     //!         frequency estimate (in Hz)
     //! \return the estimate of fundamental frequency in Hz and the 
     //!         confidence associated with that estimate (see 
@@ -731,6 +808,187 @@ private:
 };   //  end of class FundamentalFromPartials
 
 
+// ---------------------------------------------------------------------------
+//  class FundamentalTracker
+//
+//! Class FundamentalTracker represents an algorithm for low-latency
+//! fundamental frequency tracking in a stream of samples, presented
+//! in blocks of any length. It performs the same spectral analysis
+//! and peak extraction as FundamentalFromSamples, and makes one 
+//! estimate for each block of samples, using an analysis window that
+//! ends at the last sample in the block. The estimate is therefore
+//! delayed by half the length of the window (see latency()).
+//!
+//! The tracker stores the most recent window-length of samples, and
+//! reuses its spectrum analyzer and all the buffers needed for peak
+//! extraction and estimation, so that once those buffers have grown
+//! to accommodate the signal, tracking does not allocate memory.
+//! (Changing the amplitude floor, which determines the shape of 
+//! the analysis window, causes the spectrum analyzer to be rebuilt
+//! before the next estimate.)
+
+class FundamentalTracker : public FundamentalEstimator
+{
+//  -- public interface --
+
+public:
+
+//  -- lifecycle --
+
+    //! Construct a new tracker for a stream of samples at the 
+    //! specified sample rate, configured with the given analysis 
+    //! window width (main lobe, zero-to-zero) and bounds on the 
+    //! fundamental frequency estimates.
+    //!
+    //! \param  winWidthHz is the main lobe width of the Kaiser
+    //!         analysis window in Hz.
+    //! \param  sampleRate is the sampling rate (in Hz) associated
+    //!         with the stream of samples 
+    //! \param  lowerFreqBound is the lower bound on the fundamental
+    //!         frequency estimates (in Hz)
+    //! \param  upperFreqBound is the upper bound on the fundamental
+    //!         frequency estimates (in Hz)
+    //! \param  precisionHz is the precision in Hz with which the 
+    //!         fundamental estimates will be made.    
+    FundamentalTracker( double winWidthHz, double sampleRate,
+                        double lowerFreqBound, double upperFreqBound,
+                        double precisionHz = DefaultPrecisionOver100 * 0.01 );
+
+    //! Destructor    
+    ~FundamentalTracker( void );
+    
+//  -- fundamental frequency tracking --
+
+    //  track
+    //
+    //! Append a block of samples to the stream, and return an estimate
+    //! of the fundamental frequency computed using an analysis window
+    //! ending at the last sample in the block, and centered at time().
+    //! The F0Estimate returned stores the estimate of the fundamental 
+    //! frequency (in Hz) and the relative confidence (from 0 to 1) 
+    //! associated with that estimate.
+    //!
+    //! \param  sampsBeg is the beginning of the block of samples
+    //! \param  sampsEnd is the end of the block of samples
+    //! \return the estimate of fundamental frequency in Hz and the 
+    //!         confidence associated with that estimate (see 
+    //!         F0Estimate.h)
+    value_type track( const double * sampsBeg, const double * sampsEnd );
+
+    //  track
+    //
+    //! Append a block of samples to the stream, and return an estimate
+    //! of the fundamental frequency, as above.
+    //!
+    //! \param  samps is the block of samples
+    //! \return the estimate of fundamental frequency in Hz and the 
+    //!         confidence associated with that estimate (see 
+    //!         F0Estimate.h)
+    value_type track( const std::vector< double > & samps )
+    {
+        const double * sampsBeg = samps.empty() ? 0 : &samps[0];
+        return track( sampsBeg, sampsBeg + samps.size() );
+    }
+    
+    //  reset
+    //
+    //! Forget all the samples in the stream, and start over
+    //! (as if newly-constructed).
+    void reset( void );
+
+//  -- access --
+
+    //! Return the time (in seconds, relative to the first sample 
+    //! in the stream) at the center of the analysis window used to 
+    //! compute the most recent estimate. 
+    double time( void ) const;
+    
+    //! Return the delay (in seconds) between the last sample in 
+    //! a block and the time of the estimate returned by track(), 
+    //! half the length of the analysis window.
+    double latency( void ) const;
+
+    //! Return the sampling rate (in Hz) of the stream of samples.
+    double sampleRate( void ) const;
+
+    //! Return the frequency-domain main lobe width (in Hz) (measured between 
+    //! zero-crossings) of the analysis window used in spectral
+    //! analysis.           
+    double windowWidth( void ) const;
+
+    //! Return the lower bound on the fundamental frequency estimates.
+    double lowerFreqBound( void ) const;
+
+    //! Return the upper bound on the fundamental frequency estimates.
+    double upperFreqBound( void ) const;
+
+//  -- private auxiliary functions --
+
+private:
+
+    //  buildSpectrumAnalyzer
+    //
+    //! Construct the ReassignedSpectrum that will be used to perform
+    //! spectral analysis, and size the buffers accordingly, keeping
+    //! the most recent samples. 
+    void buildSpectrumAnalyzer( void );
+
+    //  reserveWorkspace
+    //
+    //! Reserve storage for the peaks and intermediate results of 
+    //! the largest possible estimate, given the spectrum analyzer,
+    //! the frequency ceiling, and the bounds on the estimates, so 
+    //! that tracking allocates no memory.
+    void reserveWorkspace( void );
+
+//  -- private member variables --
+
+    std::auto_ptr< ReassignedSpectrum > m_spectrum;
+                                //! the spectrum analyzer 
+
+    std::auto_ptr< SpectralPeakSelector > m_selector;
+                                //! the peak selector, matched to the
+                                //! spectrum analyzer
+
+    std::auto_ptr< std::vector< SpectralPeak > > m_peaks;
+                                //! storage for spectral peaks
+
+    std::vector< double > m_samples;
+                                //! the most recent window-length of samples
+                                
+    std::vector< double > m_amplitudes, m_frequencies;
+                                //! storage for the amplitudes and frequencies
+                                //! of the peaks used in estimation
+                                
+    F0Estimate::Workspace m_workspace;
+                                //! storage for intermediate results
+                                //! of estimation
+
+    double m_sampleRate;        //! the sample rate of the stream, in Hz
+    
+    double m_windowWidth;       //! the width of the main lobe of the window to 
+                                //! be used in spectral analysis, in Hz
+                                
+    double m_lowerFreqBound;    //! the lower bound on estimates, in Hz
+    
+    double m_upperFreqBound;    //! the upper bound on estimates, in Hz
+    
+    double m_cacheAmpFloor;     //! the amplitude floor used to construct the
+                                //! spectrum analyzer
+                                
+    double m_cacheFreqCeiling;  //! the frequency ceiling used to reserve
+                                //! the workspace
+                                
+    unsigned long m_numSamples; //! the number of samples in the stream so far
+    
+//  disallow these until they are implemented
+
+    FundamentalTracker( const FundamentalTracker & );
+    FundamentalTracker & operator= ( const FundamentalTracker & );
+
+};   //  end of class FundamentalTracker
+
+
 
 }   //  end of namespace Loris
 
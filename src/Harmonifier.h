@@ -39,6 +39,7 @@
 
 #include <algorithm>    // for find
 #include <memory>       // for auto_ptr
+#include <vector>
 
 //	begin namespace
 namespace Loris {
@@ -147,10 +148,10 @@ public:
     //! Apply the reference envelope to all Partials in a range.    
 #if ! defined(NO_TEMPLATE_MEMBERS)
 	template<typename Iter>
-	void harmonify( Iter b, Iter e  );
+	void harmonify( Iter b, Iter e  ) const;
 #else
     inline
-    void harmonify( PartialList::iterator b, PartialList::iterator e  );
+    void harmonify( PartialList::iterator b, PartialList::iterator e  ) const;
 #endif
 
 // -- static members --
@@ -236,6 +237,13 @@ private:
     //! Used in template constructors.
     static Envelope * createDefaultEnvelope( void );
     
+    //! Apply the reference envelope to a Partial, using the
+    //! specified buffers for storing the times of the quiet 
+    //! Breakpoints and the weights at those times (so that
+    //! the buffers can be reused for many Partials).
+    void harmonify( Partial & p, std::vector< double > & times, 
+                    std::vector< double > & weights ) const;
+    
 };
 
 // ---------------------------------------------------------------------------
@@ -338,15 +346,17 @@ Harmonifier::Harmonifier( PartialList::iterator b, PartialList::iterator e,
 //! Apply the reference envelope to all Partials in a range.    
 #if ! defined(NO_TEMPLATE_MEMBERS)
 template<typename Iter>
-void Harmonifier::harmonify( Iter b, Iter e  )
+void Harmonifier::harmonify( Iter b, Iter e  ) const
 #else
 inline
-void Harmonifier::harmonify( PartialList::iterator b, PartialList::iterator e  )
+void Harmonifier::harmonify( PartialList::iterator b, PartialList::iterator e  ) const
 #endif
 {
+    //  reuse the same buffers for all the Partials:
+    std::vector< double > times, weights;
     while ( b != e )
     {
-        harmonify( *b );
+        harmonify( *b, times, weights );
         ++b;
     }
 }    
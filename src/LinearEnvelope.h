@@ -98,6 +98,19 @@ public:
     //! \param  t is the time at which to evaluate this 
     //!         LinearEnvelope.
     virtual double valueAt( double t ) const;   
+
+    //! Evaluate this LinearEnvelope at each of a sequence of times, 
+    //! storing the values in the specified array. Times in increasing
+    //! order are evaluated by walking the breakpoints once, rather 
+    //! than searching for each time.
+    //!
+    //! \param  times is an array of n times at which to evaluate
+    //!         this LinearEnvelope
+    //! \param  values is an array of n values in which to store
+    //!         the values of this LinearEnvelope at those times
+    //! \param  n is the number of times at which to evaluate
+    virtual void valuesAt( const double * times, double * values, 
+                           unsigned long n ) const;
         
     
 //  -- envelope composition --
@@ -331,6 +331,12 @@ public:
 	//!	\post	All positions beginning with pos and extending to
 	//!			the end of this Partial have been removed.
 	Partial split( iterator pos );
+
+	//!	Exchange the Breakpoints and label of this Partial with those
+	//!	of another Partial, in constant time. 
+	//!
+	//!	\param	other is the Partial with which to exchange contents.
+	void swap( Partial & other );
 	 
 //	-- parameter interpolation/extrapolation --
 
@@ -413,6 +419,32 @@ public:
 	//!	\throw	InvalidPartial if the Partial has no Breakpoints.
 	Breakpoint parametersAt( double time, double fadeTime = ShortestSafeFadeTime ) const;
 
+	//!	Return the interpolated parameters of this Partial at
+	//!	the specified time, same as parametersAt( time, fadeTime ),
+	//!	but using (and updating) a position in this Partial as a hint
+	//!	for the Breakpoint envelope search. On return, pos is the 
+	//!	position of the first Breakpoint not earlier than time 
+	//!	(the position returned by findAfter( time )). When the
+	//!	parameters are evaluated at a sequence of increasing times,
+	//!	the search takes amortized constant time, instead of
+	//!	logarithmic time in the number of Breakpoints.
+	//!	
+	//!	\param	time is the time in seconds at which to evaluate the 
+	//!			Partial.
+	//!	\param	pos is a position in this Partial (or end()) from 
+	//!			which to start the search; it is updated to the 
+	//!			position of the first Breakpoint not earlier than
+	//!			time. 
+	//!	\param	fadeTime is the duration in seconds over which Partial
+	//!			amplitudes fade at the ends. The default value is
+	//!			ShortestSafeFadeTime, 1 ns.
+	//!	\return	A Breakpoint describing the parameters of this Partial 
+	//!			at the specified time.
+	//! \pre	The Partial must have at least one Breakpoint.
+	//!	\throw	InvalidPartial if the Partial has no Breakpoints.
+	Breakpoint parametersAt( double time, const_iterator & pos,
+							 double fadeTime = ShortestSafeFadeTime ) const;
+
 //	-- implementation --
 private:
 
@@ -42,10 +42,10 @@
  
 #include "Partial.h"
 #include "PartialList.h"
-#include "PartialPtrs.h"
 #include "SpectralPeaks.h"
 
 #include <memory>
+#include <vector>
 
 //	begin namespace
 namespace Loris {
@@ -106,15 +106,36 @@ public:
 
 private:
 
+    //  The end of each eligible track: its Partial, and the
+    //  parameters of its last (latest) Breakpoint, so that
+    //  matching peaks to tracks does not need to consult any
+    //  Partial. The end frequency normalized by the warping 
+    //  envelope is cached, because it is used in every match.
+    struct Track
+    {
+        Partial * partial;
+        double endFreq;
+        double endTime;
+        double normEndFreq;
+    };
+    typedef std::vector< Track > Tracks;
+
 // --- auxiliary member functions ---
 
-    double freq_distance( const Partial & partial, const SpectralPeak & pk );
+    //  The eligible tracks are identified by their position 
+    //  in mEligibleTracks.
+
+    double end_frequency( Tracks::size_type eligible ) const;
+
+    double freq_distance( Tracks::size_type eligible, const SpectralPeak & pk );
 
-    bool better_match( const Partial & part, const SpectralPeak & pk1,
+    bool better_match( Tracks::size_type eligible, const SpectralPeak & pk1,
 		   	           const SpectralPeak & pk2 );
-    bool better_match( const Partial & part1, 
-	  		           const Partial & part2, const SpectralPeak & pk );                       
-                       
+    bool better_match( Tracks::size_type eligible1, 
+	  		           Tracks::size_type eligible2, const SpectralPeak & pk );
+
+    void append_to_track( const Track & track, double time, const Breakpoint & bp );
+    void new_track( double time, const Breakpoint & bp );
                        
 // --- collected partials ---
 
@@ -122,8 +143,8 @@ private:
 
 // --- builder state variables ---
 		
-	PartialPtrs mEligiblePartials;
-    PartialPtrs mNewlyEligible;                 // 	keep track of eligible partials here
+	Tracks mEligibleTracks;
+    Tracks mNewlyEligible;                      // 	keep track of eligible tracks here
 
 // --- parameters ---
     	
@@ -0,0 +1,392 @@
+#ifndef INCLUDE_PARTIALFILE_H
+#define INCLUDE_PARTIALFILE_H
+/*
+ * This is the Loris C++ Class Library, implementing analysis,
+ * manipulation, and synthesis of digitized sounds using the Reassigned
+ * Bandwidth-Enhanced Additive Sound Model.
+ *
+ * Loris is Copyright (c) 1999-2010 by Kelly Fitz and Lippold Haken
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY, without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ *
+ *
+ * PartialFile.h
+ *
+ * Definition of class PartialFile, for storing Partials in the native
+ * Loris partials file format, designed to be loaded quickly.
+ *
+ * loris@cerlsoundgroup.org
+ *
+ * http://www.cerlsoundgroup.org/Loris/
+ *
+ */
+
+#include "Marker.h"
+#include "Partial.h"
+#include "PartialList.h"
+
+#include <string>
+#include <vector>
+
+//	begin namespace
+namespace Loris {
+
+// ---------------------------------------------------------------------------
+//	class PartialFile
+//
+//!	Class PartialFile represents Partials stored in the native Loris
+//!	partials file format, a binary format designed to be loaded much
+//!	faster than SDIF or Spc files, without parsing or sorting any
+//!	Breakpoint data.
+//!
+//!	A partials file has a header, an index having one entry for every
+//!	Partial (its label, number of Breakpoints, and start and end times),
+//!	the Markers, and the Breakpoint data. The Breakpoint data for each
+//!	Partial is stored in a contiguous block of five columns (time,
+//!	frequency, amplitude, bandwidth, and phase) of 64-bit floating point
+//!	values, and every block is aligned to an eight byte boundary. Each
+//!	section of the file is read with a single read, directly into the
+//!	storage that represents it in memory. Files are written in the byte
+//!	order of the host, and swapped when they are read on a host having
+//!	the other byte order.
+//!
+//!	The Breakpoint data of each Partial is available through a read-only
+//!	PartialView, which provides the columns as arrays. A Partial (for
+//!	example, for synthesis or manipulation) is constructed from a view
+//!	only when it is needed, and the index can be used to select Partials
+//!	(for example, by label or time) without accessing their data.
+//!
+//!	Synthesizer and the other Loris operations accept only Partials,
+//!	not views, so using all the Partials in a file requires constructing
+//!	every Partial (see partials()), and that construction, not reading
+//!	the file, accounts for most of the time needed to load them.
+//!
+//!	Partials can also be stored in a compressed form of the format,
+//!	in which the Breakpoint parameters are quantized within specified
+//!	error bounds and entropy coded (see writeCompressed()). Compressed
+//!	files are decoded when they are loaded, so they are accessed in
+//!	exactly the same way as uncompressed files.
+//!
+//!	Conversion to and from other formats is done using Partials, for
+//!	example, from a SdifFile sdif:
+//!
+//!		PartialFile pf( sdif.partials().begin(), sdif.partials().end() );
+//!		pf.markers() = sdif.markers();
+//!
+//!	and back again:
+//!
+//!		SdifFile sdif( pf.partials().begin(), pf.partials().end() );
+//!		sdif.markers() = pf.markers();
+//
+class PartialFile
+{
+//	-- public interface --
+public:
+
+//	-- types --
+
+	//!	The type of the Marker container in a PartialFile.
+	typedef std::vector< Marker > markers_type;
+
+	//!	The type of all size parameters for PartialFile.
+	typedef std::vector< double >::size_type size_type;
+
+// ---------------------------------------------------------------------------
+//	class PartialFile::PartialView
+//
+//!	Class PartialView provides read-only access to the Breakpoint data
+//!	of one Partial in a PartialFile, stored as five columns. The arrays
+//!	of times, frequencies, amplitudes, bandwidths, and phases are valid
+//!	only as long as the PartialFile is not modified or destroyed.
+//
+	class PartialView
+	{
+	public:
+
+		//!	Return the label of the Partial.
+		int label( void ) const { return label_; }
+
+		//!	Return the number of Breakpoints in the Partial.
+		size_type numBreakpoints( void ) const { return numBreakpoints_; }
+
+		//!	Return the time (in seconds) of the first Breakpoint in the
+		//!	Partial, 0 if it has no Breakpoints.
+		double startTime( void ) const { return startTime_; }
+
+		//!	Return the time (in seconds) of the last Breakpoint in the
+		//!	Partial, 0 if it has no Breakpoints.
+		double endTime( void ) const { return endTime_; }
+
+		//!	Return the Breakpoint times (in seconds), in increasing order.
+		const double * times( void ) const { return columns_; }
+
+		//!	Return the Breakpoint frequencies (in Hz).
+		const double * frequencies( void ) const { return columns_ + numBreakpoints_; }
+
+		//!	Return the Breakpoint amplitudes (absolute).
+		const double * amplitudes( void ) const { return columns_ + 2 * numBreakpoints_; }
+
+		//!	Return the Breakpoint bandwidths (noisiness).
+		const double * bandwidths( void ) const { return columns_ + 3 * numBreakpoints_; }
+
+		//!	Return the Breakpoint phases (in radians).
+		const double * phases( void ) const { return columns_ + 4 * numBreakpoints_; }
+
+		//!	Construct a Partial having the label and Breakpoints of the
+		//!	viewed Partial.
+		Partial partial( void ) const;
+
+	private:
+		friend class PartialFile;
+
+		PartialView( int label, size_type numBreakpoints, double startTime,
+					 double endTime, const double * columns );
+
+		int label_;
+		size_type numBreakpoints_;
+		double startTime_, endTime_;
+		const double * columns_;
+	};
+
+//	-- compression parameters --
+
+	//!	Structure storing the error bounds of the compressed partials file
+	//!	format. The error in each decoded Breakpoint parameter is at most
+	//!	half of the corresponding resolution. Elements in this struct can
+	//!	be freely modified, and are validated by writeCompressed().
+	//!
+	//!	Times are quantized to multiples of timeResolution (seconds), and
+	//!	delta-coded (Breakpoints closer together than timeResolution are
+	//!	moved apart). Quantized times are limited to 2^30 multiples of
+	//!	timeResolution, so at the default resolution, only Breakpoints
+	//!	within about 10737 seconds of time zero can be stored.
+	//!	Frequencies are coded in units of frequencyResolution (cents),
+	//!	relative to the previous Breakpoint. Amplitudes are coded in
+	//!	units of amplitudeResolution (dB), relative to amplitudeFloor,
+	//!	a linear (absolute) amplitude greater than zero, and amplitudes
+	//!	smaller than amplitudeFloor are stored as zero. Bandwidths are
+	//!	always stored using eight bits. Phases are
+	//!	coded in units of phaseResolution (radians), relative to the phase
+	//!	predicted from the decoded frequencies, or, if phaseResolution
+	//!	is zero, are not stored at all, and are reconstructed from the
+	//!	decoded frequencies when the file is loaded.
+	struct Compression
+	{
+		double timeResolution;
+		double frequencyResolution;
+		double amplitudeResolution;
+		double amplitudeFloor;
+		double phaseResolution;
+
+		//	default constructor
+		//
+	 	//!	Assign default values to the compression parameters: time
+		//!	resolution of 10 microseconds, frequency resolution of 0.1
+		//!	cent, amplitude resolution of 0.1 dB, amplitude floor of
+		//!	1.0e-6 (about -120 dB), and phase resolution of 2*Pi/1024
+		//!	radians.
+		Compression( void );
+
+		//	copy, assign, and destroy are free
+	};
+
+//	-- construction --
+
+	//!	Initialize an instance of PartialFile by loading Partial data
+	//!	from the partials file having the specified filename or path.
+	//!
+	//!	\param filename is the name of the file to load, which may be
+	//!	       compressed or not.
+	//!	\throw FileIOException if the file cannot be opened or is not
+	//!	       a valid partials file.
+ 	explicit PartialFile( const std::string & filename );
+
+	//!	Initialize an instance of PartialFile having copies of the Partials
+	//!	on the specified half-open (STL-style) range.
+	//!
+	//!	\param begin_partials is the beginning of the range of Partials
+	//!	\param end_partials is the end of the range of Partials
+	//!
+	//!	If compiled with NO_TEMPLATE_MEMBERS defined, this member accepts
+	//!	only PartialList::const_iterator arguments.
+#if !defined(NO_TEMPLATE_MEMBERS)
+	template<typename Iter>
+	PartialFile( Iter begin_partials, Iter end_partials  );
+#else
+	PartialFile( PartialList::const_iterator begin_partials,
+				 PartialList::const_iterator end_partials );
+#endif
+
+	//!	Initialize an empty instance of PartialFile having no Partials.
+	PartialFile( void );
+
+	//	copy, assign, and delete are compiler-generated
+
+//	-- access --
+
+	//!	Return a reference to the Marker (see Marker.h) container
+	//!	for this PartialFile.
+	markers_type & markers( void );
+
+	//!	Return a const reference to the Marker (see Marker.h) container
+	//!	for this PartialFile.
+	const markers_type & markers( void ) const;
+
+	//!	Return the number of Partials in this PartialFile.
+	size_type numPartials( void ) const;
+
+	//!	Return the total number of Breakpoints in all the Partials in
+	//!	this PartialFile.
+	size_type numBreakpoints( void ) const;
+
+	//!	Return a read-only view of the Partial at the specified position
+	//!	in this PartialFile.
+	//!
+	//!	\param idx is the position of the Partial, less than numPartials().
+	//!	\throw InvalidArgument if there is no such Partial.
+	PartialView view( size_type idx ) const;
+
+	//!	Return a list of Partials constructed from all the Partial data
+	//!	in this PartialFile, in order.
+	PartialList partials( void ) const;
+
+//	-- mutation --
+
+	//!	Add a copy of the specified Partial to this PartialFile.
+	//!
+	//!	\param p is the Partial to add.
+	void addPartial( const Partial & p );
+
+	//!	Add a copy of each Partial on the specified half-open (STL-style)
+	//!	range to this PartialFile.
+	//!
+	//!	\param begin_partials is the beginning of the range of Partials
+	//!	\param end_partials is the end of the range of Partials
+	//!
+	//!	If compiled with NO_TEMPLATE_MEMBERS defined, this member accepts
+	//!	only PartialList::const_iterator arguments.
+#if !defined(NO_TEMPLATE_MEMBERS)
+	template<typename Iter>
+	void addPartials( Iter begin_partials, Iter end_partials  );
+#else
+	void addPartials( PartialList::const_iterator begin_partials,
+					  PartialList::const_iterator end_partials  );
+#endif
+
+//	-- export --
+
+	//!	Export the Partials and Markers stored in this PartialFile to
+	//!	a partials file having the specified filename or path.
+	//!
+	//!	\param filename is the name of the file to create or overwrite.
+	//!	\throw FileIOException if the file cannot be written.
+	void write( const std::string & filename ) const;
+
+	//!	Export the Partials and Markers stored in this PartialFile to
+	//!	a compressed partials file having the specified filename or path.
+	//!	Breakpoint parameters are quantized within the error bounds
+	//!	described by the specified Compression parameters, and entropy
+	//!	coded separately for each Partial. The Partial labels and the
+	//!	Markers are stored exactly.
+	//!
+	//!	\param filename is the name of the file to create or overwrite.
+	//!	\param bounds describes the error bounds of the Breakpoint
+	//!	       parameters (see Compression).
+	//!	\throw InvalidArgument if the error bounds are not all positive
+	//!	       (phaseResolution may be zero), or are too small to code
+	//!	       the Breakpoint parameters (for example, if any Breakpoint
+	//!	       time is 2^30 or more multiples of timeResolution from zero).
+	//!	\throw FileIOException if the file cannot be written.
+	void writeCompressed( const std::string & filename,
+						  const Compression & bounds = Compression() ) const;
+
+//	-- implementation --
+private:
+
+	//	IndexEntry is the index information for one Partial, as stored
+	//	in the file. The offset of the Partial's data in columns_ is not
+	//	stored, it is computed from the number of Breakpoints in all the
+	//	earlier Partials.
+	struct IndexEntry
+	{
+		int label;
+		unsigned int numBreakpoints;
+		double startTime;
+		double endTime;
+	};
+
+	std::vector< IndexEntry > index_;		//	one for each Partial
+	std::vector< size_type > offsets_;		//	offset of each Partial's data in columns_
+	std::vector< double > columns_;			//	Breakpoint data for all Partials
+	markers_type markers_;
+
+	//	Load a partials file.
+	void load( const std::string & filename );
+
+	//	Decode the index and Breakpoint data of a compressed partials file.
+	void decode( const std::vector< unsigned char > & data,
+				 size_type numPartials, const Compression & bounds );
+
+};	//	end of class PartialFile
+
+// -- template members --
+
+// ---------------------------------------------------------------------------
+//	constructor from Partial range
+// ---------------------------------------------------------------------------
+//	Initialize an instance of PartialFile having copies of the Partials
+//	on the specified half-open (STL-style) range.
+//
+//	If compiled with NO_TEMPLATE_MEMBERS defined, this member accepts
+//	only PartialList::const_iterator arguments.
+//
+#if !defined(NO_TEMPLATE_MEMBERS)
+template< typename Iter >
+PartialFile::PartialFile( Iter begin_partials, Iter end_partials  )
+#else
+PartialFile::PartialFile( PartialList::const_iterator begin_partials,
+						  PartialList::const_iterator end_partials )
+#endif
+{
+	addPartials( begin_partials, end_partials );
+}
+
+// ---------------------------------------------------------------------------
+//	addPartials
+// ---------------------------------------------------------------------------
+//	Add a copy of each Partial on the specified half-open (STL-style)
+//	range to this PartialFile.
+//
+//	If compiled with NO_TEMPLATE_MEMBERS defined, this member accepts
+//	only PartialList::const_iterator arguments.
+//
+#if !defined(NO_TEMPLATE_MEMBERS)
+template<typename Iter>
+void PartialFile::addPartials( Iter begin_partials, Iter end_partials  )
+#else
+void PartialFile::addPartials( PartialList::const_iterator begin_partials,
+							   PartialList::const_iterator end_partials  )
+#endif
+{
+	while ( begin_partials != end_partials )
+	{
+		addPartial( *begin_partials );
+		++begin_partials;
+	}
+}
+
+}	//	end of namespace Loris
+
+#endif /* ndef INCLUDE_PARTIALFILE_H */
@@ -0,0 +1,293 @@
+#ifndef INCLUDE_PARTIALPIPELINE_H
+#define INCLUDE_PARTIALPIPELINE_H
+/*
+ * This is the Loris C++ Class Library, implementing analysis,
+ * manipulation, and synthesis of digitized sounds using the Reassigned
+ * Bandwidth-Enhanced Additive Sound Model.
+ *
+ * Loris is Copyright (c) 1999-2010 by Kelly Fitz and Lippold Haken
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY, without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ *
+ *
+ * PartialPipeline.h
+ *
+ * Definition of class PartialPipeline, and of the Stage classes that
+ * are composed to form a PartialPipeline.
+ *
+ * 18 Oct 2026
+ * loris@cerlsoundgroup.org
+ *
+ * http://www.cerlsoundgroup.org/Loris/
+ *
+ */
+
+#include "PartialList.h"
+
+#include <vector>
+
+//  begin namespace
+namespace Loris {
+
+class Channelizer;
+class Distiller;
+class Resampler;
+class Sieve;
+
+// ---------------------------------------------------------------------------
+//  class PartialPipeline
+//
+//! Class PartialPipeline represents a sequence of manipulations
+//! (channelizing, distilling, sifting, resampling, scaling, etc.)
+//! to be applied to a collection of Partials, as a single plan.
+//!
+//! Each manipulation (or Stage) operates either on each Partial
+//! individually (like Resampler and the PartialUtils functors),
+//! on each Partial individually while (re)assigning labels (like
+//! Channelizer), or on groups of Partials having the same label
+//! (like Distiller and Sieve). Consecutive Partial stages are fused,
+//! so that each Partial is passed through all of them before the next
+//! Partial is processed. When the plan includes label stages, the
+//! Partials are grouped by label, and the stages that follow, up to
+//! the next relabeling stage, are applied to one group at a time, from
+//! start to finish. The groups are then merged into a single collection,
+//! ordered by label, and with all unlabeled (zero-labeled) Partials at
+//! the end, as after distillation.
+//!
+//! Processing a PartialList with a PartialPipeline produces the same
+//! Partials as applying each of the stages to the whole list in turn,
+//! but makes only one pass over the Partials between relabeling stages,
+//! and never copies them.
+//!
+//! PartialPipeline is serial: the label groups are processed one after
+//! another, in the calling thread, and there is no way to process them
+//! concurrently.
+//!
+//! Additional manipulations can be defined by deriving from
+//! PartialPipeline::Stage.
+//
+class PartialPipeline
+{
+//  -- public interface --
+public:
+
+// ---------------------------------------------------------------------------
+//  class PartialPipeline::Stage
+//
+//! Stage is the abstract base class for manipulations that can be
+//! composed in a PartialPipeline. Derived classes must implement
+//! clone() and scope(), and one of the apply() members, depending
+//! on their scope.
+//
+    class Stage
+    {
+    public:
+
+        //! Enumeration of the kinds of manipulation performed
+        //! by Stages.
+        enum Scope
+        {
+            EachPartial,    //!< operate on each Partial individually,
+                            //!< without changing labels (except to zero).
+            EachLabel,      //!< operate on groups of Partials having
+                            //!< the same label, assigning no new labels
+                            //!< (except zero).
+            Relabel         //!< operate on each Partial individually,
+                            //!< and assign new labels.
+        };
+
+        //! Destroy this Stage (virtual to allow subclassing).
+        virtual ~Stage( void );
+
+        //! Return an exact copy of this Stage (following the Prototype
+        //! pattern).
+        virtual Stage * clone( void ) const = 0;
+
+        //! Return the scope of this Stage.
+        virtual Scope scope( void ) const = 0;
+
+        //! Apply this Stage to a single Partial. EachPartial and Relabel
+        //! Stages must override this member. The default implementation
+        //! throws InvalidObject.
+        //!
+        //! \param  p is the Partial to manipulate.
+        virtual void apply( Partial & p ) const;
+
+        //! Apply this Stage to a group of Partials having the same label.
+        //! EachLabel Stages must override this member. The default
+        //! implementation throws InvalidObject.
+        //!
+        //! \param  samelabel is a list of Partials all having the same
+        //!         label.
+        virtual void apply( PartialList & samelabel ) const;
+    };
+
+//  -- construction --
+
+    //! Construct a new PartialPipeline having no Stages.
+    PartialPipeline( void );
+
+    //! Construct a new PartialPipeline that is an exact copy of another,
+    //! having copies of all of its Stages.
+    //!
+    //! \param  other is the PartialPipeline to copy.
+    PartialPipeline( const PartialPipeline & other );
+
+    //! Make this PartialPipeline an exact copy of another, having
+    //! copies of all of its Stages.
+    //!
+    //! \param  rhs is the PartialPipeline to copy.
+    PartialPipeline & operator=( const PartialPipeline & rhs );
+
+    //! Destroy this PartialPipeline, and all of its Stages.
+    ~PartialPipeline( void );
+
+//  -- building --
+
+    //! Append a copy of the specified Stage to this PartialPipeline,
+    //! and return a reference to this PartialPipeline.
+    //!
+    //! \param  stage is the Stage to append.
+    PartialPipeline & append( const Stage & stage );
+
+    //! Append a channelizing Stage that uses a copy of the specified
+    //! Channelizer, and return a reference to this PartialPipeline.
+    //!
+    //! \param  channelizer is the Channelizer to use.
+    PartialPipeline & channelize( const Channelizer & channelizer );
+
+    //! Append a distilling Stage that uses a copy of the specified
+    //! Distiller, and return a reference to this PartialPipeline.
+    //!
+    //! \param  distiller is the Distiller to use.
+    PartialPipeline & distill( const Distiller & distiller );
+
+    //! Append a resampling Stage that uses a copy of the specified
+    //! Resampler, and return a reference to this PartialPipeline.
+    //!
+    //! \param  resampler is the Resampler to use.
+    PartialPipeline & resample( const Resampler & resampler );
+
+    //! Append a sifting Stage that uses a copy of the specified
+    //! Sieve, and return a reference to this PartialPipeline.
+    //!
+    //! \param  sieve is the Sieve to use.
+    PartialPipeline & sift( const Sieve & sieve );
+
+    //! Append a Stage that applies a copy of the specified functor
+    //! (like the PartialUtils AmplitudeScaler) to each Partial, and
+    //! return a reference to this PartialPipeline. The functor must
+    //! not assign new (non-zero) labels.
+    //!
+    //! \param  f is the functor to apply, f( p ) is evaluated for
+    //!         each Partial p.
+    //!
+    //! If compiled with NO_TEMPLATE_MEMBERS defined, this member
+    //! is not available, derive a Stage instead.
+#if ! defined(NO_TEMPLATE_MEMBERS)
+    template< typename Func >
+    PartialPipeline & mutate( const Func & f );
+#endif
+
+//  -- access --
+
+    //! Return the number of Stages in this PartialPipeline.
+    std::vector< Stage * >::size_type numStages( void ) const;
+
+//  -- processing --
+
+    //! Apply all the Stages of this PartialPipeline, in order, to the
+    //! specified Partials, in-place. If the PartialPipeline has any
+    //! EachLabel Stages, then on return the Partials are ordered by
+    //! label, with all unlabeled (zero-labeled) Partials at the end.
+    //!
+    //! \param  partials is the list of Partials to process.
+    void process( PartialList & partials ) const;
+
+    //! Function call operator: same as process( partials ).
+    void operator()( PartialList & partials ) const { process( partials ); }
+
+//  -- implementation --
+private:
+
+    typedef std::vector< Stage * > StageList;
+
+    StageList _stages;  //! the Stages of this pipeline, owned by it.
+
+    //  Apply the Stages on the range [first, last) to each of the
+    //  Partials in a list, fusing consecutive Partial Stages.
+    void processStages( PartialList & partials, StageList::size_type first,
+                        StageList::size_type last ) const;
+
+    //  Group Partials by label, and apply the Stages on the range
+    //  [first, last), none of which may be Relabel Stages, to each
+    //  group in turn, then merge the groups.
+    void processByLabel( PartialList & partials, StageList::size_type first,
+                         StageList::size_type last ) const;
+
+};  //  end of class PartialPipeline
+
+// ---------------------------------------------------------------------------
+//  class PartialFunctorStage
+//
+//! Class template PartialFunctorStage is a PartialPipeline::Stage that
+//! applies a copy of a functor, like the PartialUtils AmplitudeScaler,
+//! to each Partial. See PartialPipeline::mutate.
+//
+template< typename Func >
+class PartialFunctorStage : public PartialPipeline::Stage
+{
+    Func _f;
+
+public:
+
+    //! Construct a new Stage using a copy of the specified functor.
+    explicit PartialFunctorStage( const Func & f ) : _f( f ) {}
+
+    //! Return an exact copy of this Stage.
+    PartialFunctorStage * clone( void ) const
+        { return new PartialFunctorStage( *this ); }
+
+    //! Return the scope of this Stage, EachPartial.
+    Scope scope( void ) const { return EachPartial; }
+
+    //! Apply the functor to a single Partial.
+    void apply( Partial & p ) const { _f( p ); }
+
+    using PartialPipeline::Stage::apply;
+};
+
+// ---------------------------------------------------------------------------
+//  mutate
+// ---------------------------------------------------------------------------
+//! Append a Stage that applies a copy of the specified functor
+//! (like the PartialUtils AmplitudeScaler) to each Partial, and
+//! return a reference to this PartialPipeline. The functor must
+//! not assign new (non-zero) labels.
+//!
+//! \param  f is the functor to apply, f( p ) is evaluated for
+//!         each Partial p.
+//
+#if ! defined(NO_TEMPLATE_MEMBERS)
+template< typename Func >
+PartialPipeline & PartialPipeline::mutate( const Func & f )
+{
+    return append( PartialFunctorStage< Func >( f ) );
+}
+#endif
+
+}   //  end of namespace Loris
+
+#endif /* ndef INCLUDE_PARTIALPIPELINE_H */
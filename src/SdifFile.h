@@ -107,12 +107,171 @@ public:
 	//!	The type of the Partial storage in an AiffFile.
 	typedef PartialList partials_type;
 	
+// ---------------------------------------------------------------------------
+//	class SdifFile::FrameIndex
+//
+//!	Class FrameIndex maps times to the positions of the RBEP (or 1TRC)
+//!	frames in a SDIF file, so that the Partial data in a time window can
+//!	be imported without parsing the whole file. Building a FrameIndex
+//!	reads only the frame headers. A FrameIndex can be used for any
+//!	number of imports from the same (unmodified) file, and the file
+//!	must be seekable (SDIF streams are not supported).
+//
+	class FrameIndex
+	{
+	public:
+	
+		//! Build an index of the frames in the SDIF file having the
+		//! specified filename or path.
+		//!
+		//! \throw FileIOException if the file cannot be read.
+		explicit FrameIndex( const std::string & filename );
+		
+		//	copy, assign, and delete are compiler-generated
+		
+		//! Return the filename or path of the indexed file.
+		const std::string & filename( void ) const { return filename_; }
+		
+		//! Return the number of indexed RBEP (or 1TRC) frames.
+		std::vector< double >::size_type numFrames( void ) const 
+			{ return frameTimes_.size(); }
+		
+		//! Return the time of the first RBEP (or 1TRC) frame in the 
+		//! file, or 0 if there are no such frames.
+		double startTime( void ) const;
+		
+		//! Return the time of the last RBEP (or 1TRC) frame in the
+		//! file, or 0 if there are no such frames. Breakpoints in the 
+		//! last frame may be later than the frame time.
+		double endTime( void ) const;
+		
+	private:
+		friend class SdifFile;
+		
+		std::string filename_;
+		std::vector< double > frameTimes_;	//	times of data frames
+		std::vector< long > frameOffsets_;	//	positions of data frames
+		std::vector< long > otherOffsets_;	//	positions of label and marker frames
+	};
+	
+// ---------------------------------------------------------------------------
+//	class SdifFile::Writer
+//
+//!	Class Writer writes Partials to a SDIF file incrementally, as they
+//!	are completed, so that they need not all be stored before writing
+//!	begins (for example, while an analysis is still running). Call 
+//!	advance() to declare that all Partials having Breakpoints earlier 
+//!	than a specified time have been added. Frames are written (and 
+//!	flushed) as soon as their contents are final, that is, when no 
+//!	Partials added later could have Breakpoints in them, and the Writer 
+//!	stores only the Partials that may still appear in frames that are 
+//!	not yet written. Other per-Partial storage (a few words for each
+//!	Partial) is kept from the oldest Partial that is not yet written,
+//!	so it grows with the number of Partials added during the longest 
+//!	Partial, not with the number of Partials in the file.
+//!
+//!	Partials are assigned SDIF indices in the order in which they are
+//!	added, and the RBEP (or 1TRC) frames written are the same as those 
+//!	written by SdifFile::write (or write1TRC) for a list of the same 
+//!	Partials, in the same order. The labels are written in several 
+//!	RBEL frames, among and after the envelope data, as Partials are 
+//!	discarded. The RBEM (markers) frame follows the envelope data, and 
+//!	is written when the Writer is closed.
+//
+	class Writer
+	{
+	public:
+	
+		//! Open the SDIF file having the specified filename or path for
+		//! writing.
+		//!
+		//! \param filename is the SDIF file to write.
+		//! \param enhanced specifies the format, RBEP (bandwidth-enhanced,
+		//!        the default) if true, otherwise 1TRC (resampled, 
+		//!        sinusoidal).
+		//! \throw FileIOException if the file cannot be opened.
+		explicit Writer( const std::string & filename, bool enhanced = true );
+		
+		//! Destroy this Writer, closing the file if it was not closed.
+		//! Errors in closing the file are not reported, call close()
+		//! to detect them.
+		~Writer( void );
+		
+		//! Add a copy of a completed Partial, and return the SDIF index
+		//! assigned to it. Empty Partials are not written, and are not
+		//! assigned an index (-1 is returned).
+		//!
+		//! \param p is the Partial to write.
+		//! \throw InvalidArgument if the Partial has a Breakpoint earlier
+		//!        than the time most recently passed to advance().
+		//! \throw InvalidObject if the Writer was closed.
+		long addPartial( const Partial & p );
+		
+		//! Add a copy of a Marker, to be written when the Writer is
+		//! closed.
+		//!
+		//! \param m is the Marker to write.
+		void addMarker( const Marker & m );
+		
+		//! Declare that all Partials having Breakpoints earlier than the 
+		//! specified time have been added, and write all the frames that
+		//! are final. 
+		//!
+		//! \param time is the time (in seconds) before which all
+		//!        Breakpoints have been added.
+		//! \throw InvalidObject if the Writer was closed.
+		void advance( double time );
+		
+		//! Write all the remaining frames, labels, and markers, and close
+		//! the file. No Partials can be added after closing the Writer.
+		void close( void );
+		
+	private:
+		struct Impl;
+		Impl * impl_;	//	insulating implementation (defined in SdifFile.C)
+		
+		//	not implemented
+		Writer( const Writer & );
+		Writer & operator=( const Writer & );
+	};
+	
 //	-- construction --
 
     //! Initialize an instance of SdifFile by importing Partial data from
     //! the file having the specified filename or path.
  	explicit SdifFile( const std::string & filename );
  
+    //! Initialize an instance of SdifFile by importing only the Breakpoints
+    //! at times from startTime to endTime (inclusive) from the file having 
+    //! the specified filename or path. Only the frames that may contain 
+    //! such Breakpoints are read, using a FrameIndex (built for this 
+    //! import). Partials having no Breakpoints in the time window are not 
+    //! imported, and Breakpoints are not added at the window boundaries. 
+    //! All Markers and labels are imported.
+    //!
+    //! \param filename is the SDIF file to read.
+    //! \param startTime is the beginning of the time window (in seconds).
+    //! \param endTime is the end of the time window (in seconds).
+ 	SdifFile( const std::string & filename, double startTime, double endTime );
+ 
+    //! Initialize an instance of SdifFile by importing only the Breakpoints
+    //! at times from startTime to endTime (inclusive), and only in Partials
+    //! having the specified labels, from the file described by a FrameIndex.
+    //! Only the frames that may contain such Breakpoints are read. Partials 
+    //! having no Breakpoints in the time window are not imported, and 
+    //! Breakpoints are not added at the window boundaries. All Markers are 
+    //! imported. To select labels from the whole file, specify a time 
+    //! window that includes all the Breakpoints (for example, from 
+    //! -DBL_MAX to DBL_MAX).
+    //!
+    //! \param index is a FrameIndex for the SDIF file to read.
+    //! \param startTime is the beginning of the time window (in seconds).
+    //! \param endTime is the end of the time window (in seconds).
+    //! \param labels are the labels of the Partials to import, all Partials
+    //!        are imported if labels is empty (the default).
+ 	SdifFile( const FrameIndex & index, double startTime, double endTime,
+ 			  const std::vector< int > & labels = std::vector< int >() );
+ 
     //! Initialize an instance of SdifFile with copies of the Partials
     //! on the specified half-open (STL-style) range.
     //! 
@@ -197,6 +356,10 @@ private:
 	partials_type partials_;		//	Partials to store in SDIF format
 	markers_type markers_;		// 	AIFF Markers
 	
+	//	import the selected Partial data using an index
+	void importWindow( const FrameIndex & index, double startTime, double endTime,
+					   const std::vector< int > & labels );
+	
 };	//	end of class SdifFile
 
 // -- template members --
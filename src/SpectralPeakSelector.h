@@ -64,6 +64,11 @@ public:
     //  separate class, but for now, they are just separate functions.
     Peaks selectPeaks( ReassignedSpectrum & spectrum, double minFrequency = 0 );
     
+	//	Same as above, but store the peaks in the specified collection,
+	//	replacing its contents. The storage of the collection is reused,
+	//	so that selecting peaks from many spectra need not allocate memory.
+    void selectPeaks( ReassignedSpectrum & spectrum, double minFrequency, Peaks & peaks );
+    
     	
 // --- implementation ---
 private:
@@ -73,8 +78,10 @@ private:
     //
     //  Currently, the reassignment minima are used.
     
-    Peaks selectReassignmentMinima( ReassignedSpectrum & spectrum, double minFrequency );
-    Peaks selectMagnitudePeaks( ReassignedSpectrum & spectrum, double minFrequency );
+    void selectReassignmentMinima( ReassignedSpectrum & spectrum, double minFrequency,
+                                   Peaks & peaks );
+    void selectMagnitudePeaks( ReassignedSpectrum & spectrum, double minFrequency,
+                               Peaks & peaks );
         
 
 // --- member data ---
@@ -88,7 +88,7 @@ public:
     //! at the corresponding time and frequency.
     //!
     //! \param  p the Partial to modify
-	void scaleAmplitudes( Partial & p );
+	void scaleAmplitudes( Partial & p ) const;
 
 	//! Scale the amplitudes of a sequence of Partials
     //! according to the amplitude of the spectral surface
@@ -110,10 +110,10 @@ public:
     //!	of iterators over a sequence of Partials.
 #if ! defined(NO_TEMPLATE_MEMBERS)
 	template<typename Iter>
-    void scaleAmplitudes( Iter b, Iter e );
+    void scaleAmplitudes( Iter b, Iter e ) const;
 #else
     inline
-	void scaleAmplitudes( PartialList::iterator b, PartialList::iterator e );
+	void scaleAmplitudes( PartialList::iterator b, PartialList::iterator e ) const;
 #endif
     
 	//! Set the amplitude of every Breakpoint in a Partial
@@ -121,7 +121,7 @@ public:
     //! at the corresponding time and frequency.
     //!
     //! \param  p the Partial to modify
-	void setAmplitudes( Partial & p );
+	void setAmplitudes( Partial & p ) const;
     
 	//! Set the amplitudes of a sequence of Partials
     //! equal to the amplitude of the spectral surface
@@ -145,10 +145,10 @@ public:
     //!	of iterators over a sequence of Partials.
 #if ! defined(NO_TEMPLATE_MEMBERS)
 	template<typename Iter>
-    void setAmplitudes( Iter b, Iter e );
+    void setAmplitudes( Iter b, Iter e ) const;
 #else
     inline
-	void setAmplitudes( PartialList::iterator b, PartialList::iterator e );
+	void setAmplitudes( PartialList::iterator b, PartialList::iterator e ) const;
 #endif
 	
 // --- access/mutation ---
@@ -208,6 +208,29 @@ public:
     //!         and setAmplitudes
 	void setEffect( double effect );
 	
+// --- rasterization ---
+
+    //! Compute the amplitude of the surface on a regular grid of
+    //! times and frequencies, and thereafter compute the surface 
+    //! amplitude by bilinear interpolation on the grid, which is 
+    //! much faster than searching the Partials that comprise the
+    //! surface, especially for large numbers of Partials and 
+    //! Breakpoints. The grid spans the Partials comprising the 
+    //! surface, lookups outside of the grid are clamped to its 
+    //! edges. Finer grids give more accurate amplitudes, but 
+    //! require more memory, one double for each grid point.
+    //!
+    //! \pre    the time and frequency steps must be positive
+    //! \param  timeStep the time between grid points (in seconds)
+    //! \param  freqStep the frequency between grid points (in Hz)
+    //! \throw  InvalidArgument if either step is not positive, or if the
+    //!         grid would have more than 2^25 points (256 MB).
+    void rasterize( double timeStep, double freqStep );
+    
+    //! Return true if the surface has been rasterized (see rasterize()),
+    //! false otherwise.
+    bool isRasterized( void ) const;
+	
 private:
 
 //	-- instance variables --
@@ -224,8 +247,23 @@ private:
                                         //! the surface, used for normalizing the surface
                                         //! amplitude for scaleAmplitudes
     
+    std::vector< double > mRaster;      //! surface amplitudes on a regular grid, 
+                                        //! stored by time slice, or empty if the 
+                                        //! surface has not been rasterized
+    double mRasterTime0;                //! time of the first slice of the raster
+    double mRasterTimeStep;             //! time between slices of the raster
+    double mRasterFreqStep;             //! frequency between grid points in a slice
+    std::vector< double >::size_type mRasterNumTimes;   //! number of slices in the raster
+    std::vector< double >::size_type mRasterNumFreqs;   //! number of grid points in a slice
+    
 // --- private helpers ---
 
+    //  Return the amplitude of the surface at the specified frequency and
+    //  time (not stretched), using the raster if the surface has been
+    //  rasterized, otherwise searching the Partials, starting from (and 
+    //  updating) the specified position hint.
+    double surfaceAt( double f, double t, std::vector< Partial >::size_type & hint ) const;
+
     //  helper used by constructor for adding Partials one by one
     void addPartialAux( const Partial & p );
     
@@ -256,7 +294,12 @@ SpectralSurface::SpectralSurface( PartialList::iterator b,
 	mStretchFreq( 1.0 ),
 	mStretchTime( 1.0 ),
 	mEffect( 1.0 ),
-    mMaxSurfaceAmp( 0.0 )
+    mMaxSurfaceAmp( 0.0 ),
+    mRasterTime0( 0.0 ),
+    mRasterTimeStep( 0.0 ),
+    mRasterFreqStep( 0.0 ),
+    mRasterNumTimes( 0 ),
+    mRasterNumFreqs( 0 )
 {
     //  add only labeled Partials:
     while ( b != e )
@@ -308,11 +351,11 @@ SpectralSurface::SpectralSurface( PartialList::iterator b,
 //
 #if ! defined(NO_TEMPLATE_MEMBERS)
 template<typename Iter>
-void SpectralSurface::scaleAmplitudes( Iter b, Iter e )
+void SpectralSurface::scaleAmplitudes( Iter b, Iter e ) const
 #else
 inline
 void SpectralSurface::scaleAmplitudes( PartialList::iterator b, 
-                                       PartialList::iterator e )
+                                       PartialList::iterator e ) const
 #endif
 {	
 	while ( b != e )
@@ -349,11 +392,11 @@ void SpectralSurface::scaleAmplitudes( PartialList::iterator b,
 //
 #if ! defined(NO_TEMPLATE_MEMBERS)
 template<typename Iter>
-void SpectralSurface::setAmplitudes( Iter b, Iter e )
+void SpectralSurface::setAmplitudes( Iter b, Iter e ) const
 #else
 inline
 void SpectralSurface::setAmplitudes( PartialList::iterator b, 
-                                     PartialList::iterator e )
+                                     PartialList::iterator e ) const
 #endif
 {	
 	while ( b != e )
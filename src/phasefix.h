@@ -141,13 +141,31 @@ void fixPhaseBetween( Partial::iterator b, Partial::iterator e );
 //
 void fixFrequency( Partial & partial, double maxFixPct = 0.2 );
 
+//	fixFrequencies
+//
+//!	Adjust frequencies of the Breakpoints in several
+//! Partials, as in fixFrequency( partial, maxFixPct ).
+//! The Partials are corrected together, which is faster 
+//! than correcting them one at a time.
+//!
+//!  \param     partials An array of n pointers to distinct Partials
+//!             whose frequencies, and possibly phases, will be 
+//!             recomputed.
+//!  \param     n The number of Partials.
+//!  \param     maxFixPct The maximum allowable frequency 
+//!             alteration, default is 0.2%.
+//
+void fixFrequencies( Partial * const * partials, unsigned long n, 
+                     double maxFixPct = 0.2 );
+
 //	fixFrequency
 //
 //!	Adjust frequencies of the Breakpoints in the 
 //! specified Partials such that the rendered Partial 
 //!	achieves (or matches as nearly as possible, within 
 //!	the constraint of the maximum allowable frequency
-//! alteration) the analyzed phases. 
+//! alteration) the analyzed phases. The Partials are 
+//! corrected several at a time (see fixFrequencies).
 //!
 //! \param		b The beginning of a range of Partials whose 
 //!             frequencies should be fixed.
@@ -159,10 +177,17 @@ void fixFrequency( Partial & partial, double maxFixPct = 0.2 );
 template < class Iter >
 void fixFrequency( Iter b, Iter e, double maxFixPct = 0.2 )
 {
+    const unsigned long GroupSize = 64;
+    Partial * group[ GroupSize ];
     while ( b != e )
     {
-        fixFrequency( *b, maxFixPct );
-        ++b;
+        unsigned long n = 0;
+        while ( n < GroupSize && b != e )
+        {
+            group[ n++ ] = &( *b );
+            ++b;
+        }
+        fixFrequencies( group, n, maxFixPct );
     }
 }
 